@@ -0,0 +1,37 @@
+#!/bin/bash
+
+# Compare the messaging modes of teste.C (per-message, aggregated and pooled)
+# on the same config file. Use a config with a small load to measure messaging costs.
+
+if [ $# -ne 1 ] && [ $# -ne 2 ]
+then
+	echo "usage: bash bench_messages.sh config_file [number_of_processors]"
+	exit 1
+fi
+
+if [ ! -f $1  ]
+then
+	echo "Error: $1 file not found."
+	exit 1
+fi
+
+PES=${2:-1}
+MODES="per_message aggregated pooled"
+
+MODE=0
+for NAME in $MODES
+do
+	DEFS="-DMESSAGE_MODE=$MODE" bash build.sh $1 teste_$NAME > /dev/null || exit 1
+	MODE=$((MODE + 1))
+done
+
+printf "%-12s %15s %20s %18s\n" "mode" "messages" "iteration time (ms)" "msgs/s"
+for NAME in $MODES
+do
+	OUTPUT=$(./teste_$NAME +p$PES)
+	MSGS=$(echo "$OUTPUT" | grep "^Messages sent" | awk '{print $3}')
+	TIME=$(echo "$OUTPUT" | grep "^Iteration total time" | awk '{print $4}')
+	RATE=$(echo "$OUTPUT" | grep "^Message rate" | awk '{print $3}')
+	printf "%-12s %15s %20s %18s\n" $NAME $MSGS $TIME $RATE
+	rm -f teste_$NAME
+done
@@ -0,0 +1,55 @@
+#ifndef COMMGRAPH_H
+#define COMMGRAPH_H
+
+#include <string>
+#include <vector>
+
+/* Communication graph stored in compressed sparse row (CSR) form. The receivers
+   of task t are receivers[receiversOffset[t] .. receiversOffset[t+1]), in the
+   order used by the neighbor argument of getMessageNumber and getMessageSize.
+   The senders are stored the same way, together with the reverse-edge indices,
+   so no task has to re-derive the geometry of its neighbors. */
+class CommunicationGraph {
+	public:
+	int numberOfTasks;
+
+	std::vector<long> receiversOffset;
+	std::vector<int> receivers;
+	std::vector<int> receiverSlot; //for each receiver edge, its index in the receiver's senders list
+
+	std::vector<long> sendersOffset;
+	std::vector<int> senders;
+	std::vector<int> indexInSendersReceiversList; //for each sender edge, its index in the sender's receivers list
+
+	//build a graph of a CommGraph type; returns false and sets error on failure
+	bool build(int type, int numberOfTasks, int degree, int seed, const std::string &fileName, std::string &error);
+
+	//the lists are NULL for a graph without edges
+	int getNumberOfReceivers(int task) const { return receiversOffset[task + 1] - receiversOffset[task]; }
+	const int *getReceivers(int task) const { return edgeList(receivers, receiversOffset[task]); }
+	const int *getReceiverSlots(int task) const { return edgeList(receiverSlot, receiversOffset[task]); }
+	int getNumberOfSenders(int task) const { return sendersOffset[task + 1] - sendersOffset[task]; }
+	const int *getSenders(int task) const { return edgeList(senders, sendersOffset[task]); }
+	const int *getIndexInSendersReceiversList(int task) const { return edgeList(indexInSendersReceiversList, sendersOffset[task]); }
+	long getNumberOfEdges() const { return receivers.size(); }
+
+	private:
+	//edges in generation order, turned into the CSR arrays by buildFromEdges
+	std::vector<int> edgeSources;
+	std::vector<int> edgeTargets;
+
+	static const int *edgeList(const std::vector<int> &list, long offset){ return list.empty() ? NULL : &list[0] + offset; }
+	void addEdge(int source, int target){ edgeSources.push_back(source); edgeTargets.push_back(target); }
+	void buildFromEdges();
+
+	void createRing();
+	void create2DMesh(bool periodic);
+	void create3DMesh(bool periodic);
+	void createKNearest(int degree);
+	void createRandomRegular(int degree, int seed);
+	void createAllToAll();
+	void createPowerLaw(int degree, int seed);
+	bool readEdgeList(const std::string &fileName, std::string &error);
+};
+
+#endif
@@ -0,0 +1,58 @@
+#ifndef CONFIG_H
+#define CONFIG_H
+
+#include <string>
+
+/* Functions that describe the simulated application. They are either generated
+   by config_reader from a config file (configHeader.h) or evaluated at runtime
+   by a RuntimeConfig (runtime_config.h). */
+
+enum CommGraph	{
+	Ring = 0,
+	Mesh2D = 1,
+	Mesh3D = 2,
+	Torus2D = 3, //periodic 2D mesh, the lines of a non-square n wrap within their tasks
+	Torus3D = 4, //periodic 3D mesh, the lines of a non-cube n wrap within their tasks
+	KNearest = 5, //gdegree nearest tasks on a periodic line
+	RandomRegular = 6, //gdegree different random receivers and senders for each task (at most n-1)
+	AllToAll = 7,
+	PowerLaw = 8, //preferential attachment, gdegree edges for each new task
+	EdgeListFile = 9 //edges read from gfile
+};
+
+enum Kernel {
+	IntOps = 0, //integer divide chain
+	FloatOps = 1, //sqrt(cos())
+	Triad = 2, //streaming triad over the task's data
+	PointerChase = 3, //dependent loads over the task's data
+	Fma = 4, //independent multiply-adds, vectorized
+	Stencil = 5, //3-point stencil over the task's data and the neighbors' payloads
+	NUM_KERNELS
+};
+
+int getNumberOfTasks();
+int getNumberOfIterations();
+int getLBFrequency();
+int getInitialMapping(int task, int numPes);
+int getCommunicationGraph();
+int getGraphDegree();
+int getGraphSeed();
+std::string getGraphFile();
+bool getIntOper(int task, int iteration);
+int getKernel(int task, int iteration);
+int getTaskSize(int task);
+int getMessageSize(int task, int iteration, int neighbor, int msgIndex);
+int getMessageNumber(int task, int iteration, int neighbor);
+bool isMessageNumberIterationInvariant();
+int getLoad(int task, int iteration);
+int getLoad(int task, int iteration, int previousIteration, int previousLoad);
+std::string getExpr(std::string attribute);
+
+//check that a value of the kernel expression is a kernel; defined by the program, which aborts if it is not
+int checkKernel(double kernel, int task, int iteration);
+
+inline bool isKernel(double kernel){
+	return kernel >= 0 && kernel < NUM_KERNELS && kernel == (int)kernel;
+}
+
+#endif
@@ -0,0 +1,124 @@
+#ifndef CONFIG_FILE_H
+#define CONFIG_FILE_H
+
+#include <fstream>
+#include <string>
+
+/* Expressions read from a config file */
+struct ConfigFile {
+	std::string taskNumberExp, iterNumberExp, gCommExp, lbFreqExp, intOperExp, taskSizeExp, loadExp, msgSizeExp, msgNumExp, initMapExp, kernelExp;
+	std::string gDegreeExp, gSeedExp, gFileExp;
+
+	static void trim(std::string &exp){
+		std::string chars = " \t\r";
+		size_t pos = exp.find_last_not_of(chars);
+		if(pos != std::string::npos){
+			exp.erase(pos + 1);
+			pos = exp.find_first_not_of(chars);
+			if(pos != std::string::npos) exp.erase(0, pos);
+		}
+		else exp.erase(exp.begin(), exp.end());
+	}
+
+	static void replaceAll(std::string& str, const std::string& from, const std::string& to) {
+		if(from.empty()) return;
+		size_t start_pos = 0;
+		while((start_pos = str.find(from, start_pos)) != std::string::npos) {
+			str.replace(start_pos, from.length(), to);
+			start_pos += to.length(); // In case 'to' contains 'from', like replacing 'x' with 'yx'
+		}
+	}
+
+	//open config file and get parameters' expressions; returns false and sets error on failure
+	bool read(const std::string &fileName, std::string &error){
+		std::string line;
+		std::ifstream configFile(fileName.c_str());
+		if(!configFile.is_open()){
+			error = "could not open " + fileName;
+			return false;
+		}
+		while(getline(configFile, line)){
+			if(line.length() == 0) continue; //skip empty line
+			else if(line[0] == '#') continue; //skip comment
+
+			else if(line[0] == 'n') //read number of tasks
+				taskNumberExp = line.erase(0, line.find('=') + 1);
+			else if(line[0] == 'r') //read number of iterations
+				iterNumberExp = line.erase(0, line.find('=') + 1);
+			else if(line.substr(0,5) == "gcomm") //read communication graph
+				gCommExp = line.erase(0, line.find('=') + 1);
+			else if(line.substr(0,7) == "gdegree") //read communication graph degree
+				gDegreeExp = line.erase(0, line.find('=') + 1);
+			else if(line.substr(0,5) == "gseed") //read communication graph random seed
+				gSeedExp = line.erase(0, line.find('=') + 1);
+			else if(line.substr(0,5) == "gfile") //read communication graph edge list file
+				gFileExp = line.erase(0, line.find('=') + 1);
+			else if(line.substr(0,6) == "lbfreq") //read lb frequency expression
+				lbFreqExp = line.erase(0, line.find('=') + 1);
+			else if(line.substr(0,6) == "int_op") //read int operations expression
+				intOperExp = line.erase(0, line.find('=') + 1);
+			else if(line.substr(0,8) == "tasksize") //read task size expression
+				taskSizeExp = line.erase(0, line.find('=') + 1);
+			else if(line.substr(0,6) == "kernel") //read work kernel expression
+				kernelExp = line.erase(0, line.find('=') + 1);
+			else if(line.substr(0,4) == "load") //read load expression
+				loadExp = line.erase(0, line.find('=') + 1);
+			else if(line.substr(0,7) == "msgsize") //read message size expression
+				msgSizeExp = line.erase(0, line.find('=') + 1);
+			else if(line.substr(0,6) == "msgnum") //read message number expression
+				msgNumExp = line.erase(0, line.find('=') + 1);
+			else if(line.substr(0,7) == "initmap") //read initial mapping expression
+				initMapExp = line.erase(0, line.find('=') + 1);
+			else{
+				error = "error while reading line:\n" + line;
+				return false;
+			}
+		}
+
+		//remove extra white spaces of an expression
+		trim(taskNumberExp);
+		trim(iterNumberExp);
+		trim(gCommExp);
+		trim(lbFreqExp);
+		trim(intOperExp);
+		trim(taskSizeExp);
+		trim(loadExp);
+		trim(msgSizeExp);
+		trim(msgNumExp);
+		trim(initMapExp);
+		trim(kernelExp);
+		trim(gDegreeExp);
+		trim(gSeedExp);
+		trim(gFileExp);
+
+		//communication graph parameters are optional
+		if(gDegreeExp.empty()) gDegreeExp = "4";
+		if(gSeedExp.empty()) gSeedExp = "1";
+		return true;
+	}
+
+	//expression of an attribute as shown by getExpr()
+	std::string getExpr(const std::string &attribute) const {
+		if(attribute == "n") return taskNumberExp;
+		else if(attribute == "r") return iterNumberExp;
+		else if(attribute == "gcomm") return gCommExp;
+		else if(attribute == "gdegree") return gDegreeExp;
+		else if(attribute == "gseed") return gSeedExp;
+		else if(attribute == "gfile") return gFileExp;
+		else if(attribute == "lbfreq") return lbFreqExp;
+		else if(attribute == "int_op") return intOperExp;
+		else if(attribute == "kernel") return kernelExp;
+		else if(attribute == "tasksize") return taskSizeExp;
+		else if(attribute == "load"){
+			std::string exp = loadExp;
+			replaceAll(exp, "$", "getLoad(t,i-1)");
+			return exp;
+		}
+		else if(attribute == "msgsize") return msgSizeExp;
+		else if(attribute == "msgnum") return msgNumExp;
+		else if(attribute == "initmap") return initMapExp;
+		return "";
+	}
+};
+
+#endif
@@ -1,28 +1,26 @@
-#include <fstream>
 #include <iostream>
 #include <string>
-#include <algorithm>
+#include <cctype>
+#include "config_file.h"
 
 using namespace std;
 
-void trim(string &exp){
-	string chars = " \t";
-	int pos = exp.find_last_not_of(chars);
-	if(pos != string::npos){
-		exp.erase(pos + 1);
-		pos = exp.find_first_not_of(chars);
-		if(pos != string::npos) exp.erase(0, pos);
+//check if an expression uses a variable (or function) name
+bool usesIdentifier(const string &exp, const string &name){
+	size_t pos = 0;
+	while(pos < exp.length()){
+		if(isalpha(exp[pos]) || exp[pos] == '_'){
+			size_t end = pos;
+			while(end < exp.length() && (isalnum(exp[end]) || exp[end] == '_')) end++;
+			if(exp.substr(pos, end - pos) == name) return true;
+			pos = end;
+		}
+		else if(isdigit(exp[pos])){ //skip numbers like 1e3
+			while(pos < exp.length() && (isalnum(exp[pos]) || exp[pos] == '.')) pos++;
+		}
+		else pos++;
 	}
-	else exp.erase(exp.begin(), exp.end());
-}
-
-void replaceAll(string& str, const string& from, const string& to) {
-    if(from.empty()) return;
-    size_t start_pos = 0;
-    while((start_pos = str.find(from, start_pos)) != std::string::npos) {
-        str.replace(start_pos, from.length(), to);
-        start_pos += to.length(); // In case 'to' contains 'from', like replacing 'x' with 'yx'
-    }
+	return false;
 }
 
 int main(int argc, char **argv){
@@ -30,52 +28,17 @@ int main(int argc, char **argv){
 	string fileName = argv[1];
 
 	//open config file and get parameters' expressions
-	string taskNumberExp, iterNumberExp, gCommExp, lbFreqExp, intOperExp, taskSizeExp, loadExp, msgSizeExp, msgNumExp, initMapExp;
-	string line;
-	fstream configFile;
-	configFile.open(fileName.c_str());
-	while(!configFile.eof()){
-		getline(configFile, line);
-		if(line.length() == 0) continue; //skip empty line
-		else if(line[0] == '#') continue; //skip comment
-
-		else if(line[0] == 'n') //read number of tasks
-			taskNumberExp = line.erase(0, line.find('=') + 1);
-		else if(line[0] == 'r') //read number of iterations
-			iterNumberExp = line.erase(0, line.find('=') + 1);
-		else if(line.substr(0,5) == "gcomm") //read communication graph
-			gCommExp = line.erase(0, line.find('=') + 1);
-		else if(line.substr(0,6) == "lbfreq") //read lb frequency expression
-			lbFreqExp = line.erase(0, line.find('=') + 1);
-		else if(line.substr(0,6) == "int_op") //read int operations expression
-			intOperExp = line.erase(0, line.find('=') + 1);
-		else if(line.substr(0,8) == "tasksize") //read task size expression
-			taskSizeExp = line.erase(0, line.find('=') + 1);
-		else if(line.substr(0,4) == "load") //read load expression
-			loadExp = line.erase(0, line.find('=') + 1);
-		else if(line.substr(0,7) == "msgsize") //read message size expression
-			msgSizeExp = line.erase(0, line.find('=') + 1);
-		else if(line.substr(0,6) == "msgnum") //read message number expression
-			msgNumExp = line.erase(0, line.find('=') + 1);
-		else if(line.substr(0,7) == "initmap") //read initial mapping expression
-			initMapExp = line.erase(0, line.find('=') + 1);
-		else{
-			cout << "error while reading line:\n" << line << endl; break;
-		}
+	ConfigFile config;
+	string error;
+	if(!config.read(fileName, error)){
+		cerr << error << endl;
+		return 1;
 	}
-	configFile.close();
-
-	//remove extra white spaces of an expression
-	trim(taskNumberExp);
-	trim(iterNumberExp);
-	trim(gCommExp);
-	trim(lbFreqExp);
-	trim(intOperExp);
-	trim(taskSizeExp);
-	trim(loadExp);
-	trim(msgSizeExp);
-	trim(msgNumExp);
-	trim(initMapExp);
+	string taskNumberExp = config.taskNumberExp, iterNumberExp = config.iterNumberExp, gCommExp = config.gCommExp;
+	string lbFreqExp = config.lbFreqExp, intOperExp = config.intOperExp, taskSizeExp = config.taskSizeExp, loadExp = config.loadExp;
+	string msgSizeExp = config.msgSizeExp, msgNumExp = config.msgNumExp, initMapExp = config.initMapExp;
+	string kernelExp = config.kernelExp;
+	string gDegreeExp = config.gDegreeExp, gSeedExp = config.gSeedExp, gFileExp = config.gFileExp;
 
 	cout << "#include <cmath>" << endl;
 	cout << "#include <string>" << endl;
@@ -105,6 +68,18 @@ int main(int argc, char **argv){
 		cout << "\treturn (int)" << gCommExp << ";" << endl;
 	cout << "}" << endl;
 
+	cout << "int getGraphDegree(){" << endl;
+		cout << "\treturn " << gDegreeExp << ";" << endl;
+	cout << "}" << endl;
+
+	cout << "int getGraphSeed(){" << endl;
+		cout << "\treturn " << gSeedExp << ";" << endl;
+	cout << "}" << endl;
+
+	cout << "string getGraphFile(){" << endl;
+		cout << "\treturn \"" << gFileExp << "\";" << endl;
+	cout << "}" << endl;
+
 	cout << "bool getIntOper(int task, int iteration){" << endl;
 		cout << "\tint n = " << taskNumberExp << ";" << endl;
 		cout << "\tint r = " << iterNumberExp << ";" << endl;
@@ -113,6 +88,19 @@ int main(int argc, char **argv){
 		cout << "\treturn " << intOperExp << ";" << endl;
 	cout << "}" << endl;
 
+	//without a kernel expression, int_op selects between the IntOps and FloatOps kernels
+	cout << "int getKernel(int task, int iteration){" << endl;
+	if(kernelExp.empty())
+		cout << "\treturn getIntOper(task, iteration) ? IntOps : FloatOps;" << endl;
+	else{
+		cout << "\tint n = " << taskNumberExp << ";" << endl;
+		cout << "\tint r = " << iterNumberExp << ";" << endl;
+		cout << "\tint t = task;" << endl;
+		cout << "\tint i = iteration;" << endl;
+		cout << "\treturn checkKernel(" << kernelExp << ", task, iteration);" << endl;
+	}
+	cout << "}" << endl;
+
 	cout << "int getTaskSize(int task){" << endl;
 		cout << "\tint n = " << taskNumberExp << ";" << endl;
 		cout << "\tint r = " << iterNumberExp << ";" << endl;
@@ -139,15 +127,31 @@ int main(int argc, char **argv){
 		cout << "\treturn " << msgNumExp << ";" << endl;
 	cout << "}" << endl;
 
+	cout << "bool isMessageNumberIterationInvariant(){" << endl;
+		cout << "\treturn " << (usesIdentifier(msgNumExp, "i") ? "false" : "true") << ";" << endl;
+	cout << "}" << endl;
+
+	//recursive version: '$' is the load of the previous iteration
+	string memoLoadExp = loadExp;
 	cout << "int getLoad(int task, int iteration){" << endl;
 		cout << "\tint n = " << taskNumberExp << ";" << endl;
 		cout << "\tint r = " << iterNumberExp << ";" << endl;
 		cout << "\tint t = task;" << endl;
 		cout << "\tint i = iteration;" << endl;
-		replaceAll(loadExp, "$", "getLoad(t,i-1)");
+		ConfigFile::replaceAll(loadExp, "$", "getLoad(t,i-1)");
 		cout << "\treturn " << loadExp << ";" << endl;
 	cout << "}" << endl;
 
+	//incremental version: '$' is taken from the load the task computed in the previous iteration
+	cout << "int getLoad(int task, int iteration, int previousIteration, int previousLoad){" << endl;
+		cout << "\tint n = " << taskNumberExp << ";" << endl;
+		cout << "\tint r = " << iterNumberExp << ";" << endl;
+		cout << "\tint t = task;" << endl;
+		cout << "\tint i = iteration;" << endl;
+		ConfigFile::replaceAll(memoLoadExp, "$", "(previousIteration == i-1 ? previousLoad : getLoad(t,i-1))");
+		cout << "\treturn " << memoLoadExp << ";" << endl;
+	cout << "}" << endl;
+
 	//print info function
 	cout << "string getExpr(string attribute){" << endl;
 		cout << "\tif(attribute == \"n\")" << endl;
@@ -156,10 +160,18 @@ int main(int argc, char **argv){
 			cout << "\t\treturn \"" << iterNumberExp << "\";" << endl;
 		cout << "\telse if(attribute == \"gcomm\")" << endl;
 			cout << "\t\treturn \"" << gCommExp << "\";" << endl;
+		cout << "\telse if(attribute == \"gdegree\")" << endl;
+			cout << "\t\treturn \"" << gDegreeExp << "\";" << endl;
+		cout << "\telse if(attribute == \"gseed\")" << endl;
+			cout << "\t\treturn \"" << gSeedExp << "\";" << endl;
+		cout << "\telse if(attribute == \"gfile\")" << endl;
+			cout << "\t\treturn \"" << gFileExp << "\";" << endl;
 		cout << "\telse if(attribute == \"lbfreq\")" << endl;
 			cout << "\t\treturn \"" << lbFreqExp << "\";" << endl;
 		cout << "\telse if(attribute == \"int_op\")" << endl;
 			cout << "\t\treturn \"" << intOperExp << "\";" << endl;
+		cout << "\telse if(attribute == \"kernel\")" << endl;
+			cout << "\t\treturn \"" << kernelExp << "\";" << endl;
 		cout << "\telse if(attribute == \"tasksize\")" << endl;
 			cout << "\t\treturn \"" << taskSizeExp << "\";" << endl;
 		cout << "\telse if(attribute == \"load\")" << endl;
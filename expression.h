@@ -0,0 +1,82 @@
+#ifndef EXPRESSION_H
+#define EXPRESSION_H
+
+#include <string>
+#include <vector>
+
+/* Variables an expression can use */
+enum ExpressionVariable {
+	VAR_N = 0, //number of tasks
+	VAR_R, //number of iterations
+	VAR_T, //task
+	VAR_I, //iteration
+	VAR_V, //neighbor
+	VAR_U, //message index
+	VAR_P, //number of processors
+	NUM_VARIABLES
+};
+
+/* Values of the variables used to evaluate an expression. If hasPrevious is set,
+   previousIteration and previousValue memoize '$' (the value of the expression in
+   iteration i-1); any iteration, including -1, can be memoized. */
+struct ExpressionContext {
+	int vars[NUM_VARIABLES];
+	bool hasPrevious;
+	int previousIteration;
+	int previousValue;
+
+	ExpressionContext(){
+		for(int i = 0; i < NUM_VARIABLES; i++) vars[i] = 0;
+		hasPrevious = false;
+		previousIteration = 0;
+		previousValue = 0;
+	}
+};
+
+/* Named integer constant an expression can use (e.g. Ring) */
+struct ExpressionConstant {
+	std::string name;
+	int value;
+};
+
+/* A C arithmetic expression (the language accepted by config_reader) compiled once
+   into a typed stack bytecode. int and double values follow the C rules, so
+   evaluate*() returns the same results as the code generated by config_reader. */
+class Expression {
+	public:
+	//compile source; variables is a bit mask of (1 << ExpressionVariable) and allowPrevious enables '$'
+	bool compile(const std::string &source, int variables, bool allowPrevious, const std::vector<ExpressionConstant> &constants, std::string &error);
+
+	int evaluateInt(const ExpressionContext &context) const;
+	bool evaluateBool(const ExpressionContext &context) const;
+	double evaluateDouble(const ExpressionContext &context) const;
+
+	//check if the compiled expression reads a variable
+	bool usesVariable(int variable) const { return (usedVariables & (1 << variable)) != 0; }
+
+	Expression(){ resultIsDouble = false; usedVariables = 0; }
+
+	struct Instruction {
+		int opcode;
+		int operand;
+		union {
+			double constant;
+			double (*function1)(double);
+			double (*function2)(double, double);
+		};
+	};
+
+	private:
+	union Value {
+		int i;
+		double d;
+	};
+
+	std::vector<Instruction> code;
+	bool resultIsDouble;
+	int usedVariables;
+
+	Value run(const ExpressionContext &context) const;
+};
+
+#endif
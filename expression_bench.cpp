@@ -0,0 +1,132 @@
+#include <iostream>
+#include <cstdlib>
+#include <algorithm>
+#include <sys/time.h>
+#include "config.h"
+#include "configHeader.h"
+#include "runtime_config.h"
+
+using namespace std;
+
+/* Compare the evaluation cost of the functions generated by config_reader
+   (configHeader.h) with the expressions compiled at runtime by RuntimeConfig. */
+
+double wallTime(){
+	struct timeval tv;
+	gettimeofday(&tv, NULL);
+	return tv.tv_sec + tv.tv_usec * 1e-6;
+}
+
+//getKernel of both versions calls it
+int checkKernel(double kernel, int task, int iteration){
+	if(!isKernel(kernel)){
+		cout << "Error: kernel = " << getExpr("kernel") << " is " << kernel << " for task " << task << " in iteration " << iteration << ", which is not a kernel" << endl;
+		exit(1);
+	}
+	return (int)kernel;
+}
+
+volatile long sink; //every call adds to it, so the compiler cannot fold or hoist the evaluations
+
+int main(int argc, char **argv){
+	if(argc != 2 && argc != 3){
+		cout << "usage: bench_expr config_file [max_tasks]" << endl;
+		return 1;
+	}
+
+	RuntimeConfig config;
+	string error;
+	if(!config.read(argv[1], error)){
+		cout << error << endl;
+		return 1;
+	}
+
+	int tasks = min(config.numberOfTasks, (argc == 3) ? atoi(argv[2]) : 1000);
+	int iterations = config.numberOfIterations;
+	int neighbors = 4, msgs = 4;
+	long calls, mismatches;
+	double start, nativeTime, runtimeTime;
+
+	//the generated functions are called through volatile pointers, so they are neither inlined nor hoisted out of the loops
+	int (*volatile nativeGetLoad)(int, int, int, int) = getLoad;
+	bool (*volatile nativeGetIntOper)(int, int) = getIntOper;
+	int (*volatile nativeGetMessageNumber)(int, int, int) = getMessageNumber;
+	int (*volatile nativeGetMessageSize)(int, int, int, int) = getMessageSize;
+
+	cout << "function\t\tcalls\tnative (ns/call)\truntime (ns/call)\tmismatches" << endl;
+
+	//getLoad, incremental as in Task::updateAttributes
+	calls = (long)tasks * iterations; mismatches = 0;
+	start = wallTime();
+	for(int t = 0; t < tasks; t++){
+		int previous = getLoad(t, 1);
+		for(int i = 2; i <= iterations; i++) sink += previous = nativeGetLoad(t, i, i - 1, previous);
+	}
+	nativeTime = wallTime() - start;
+	start = wallTime();
+	for(int t = 0; t < tasks; t++){
+		int previous = config.getLoad(t, 1);
+		for(int i = 2; i <= iterations; i++) sink += previous = config.getLoad(t, i, i - 1, previous);
+	}
+	runtimeTime = wallTime() - start;
+	for(int t = 0; t < tasks; t++){
+		int nativePrevious = getLoad(t, 1), runtimePrevious = config.getLoad(t, 1);
+		for(int i = 2; i <= iterations; i++){
+			nativePrevious = getLoad(t, i, i - 1, nativePrevious);
+			runtimePrevious = config.getLoad(t, i, i - 1, runtimePrevious);
+			if(nativePrevious != runtimePrevious) mismatches++;
+		}
+	}
+	cout << "getLoad\t\t\t" << calls << "\t" << nativeTime / calls * 1e9 << "\t\t\t" << runtimeTime / calls * 1e9 << "\t\t\t" << mismatches << endl;
+
+	//getIntOper
+	mismatches = 0;
+	start = wallTime();
+	for(int t = 0; t < tasks; t++) for(int i = 1; i <= iterations; i++) sink += nativeGetIntOper(t, i);
+	nativeTime = wallTime() - start;
+	start = wallTime();
+	for(int t = 0; t < tasks; t++) for(int i = 1; i <= iterations; i++) sink += config.getIntOper(t, i);
+	runtimeTime = wallTime() - start;
+	for(int t = 0; t < tasks; t++) for(int i = 1; i <= iterations; i++) mismatches += (getIntOper(t, i) != config.getIntOper(t, i));
+	cout << "getIntOper\t\t" << calls << "\t" << nativeTime / calls * 1e9 << "\t\t\t" << runtimeTime / calls * 1e9 << "\t\t\t" << mismatches << endl;
+
+	//getMessageNumber
+	calls = (long)tasks * iterations * neighbors; mismatches = 0;
+	start = wallTime();
+	for(int t = 0; t < tasks; t++) for(int i = 1; i <= iterations; i++) for(int v = 0; v < neighbors; v++) sink += nativeGetMessageNumber(t, i, v);
+	nativeTime = wallTime() - start;
+	start = wallTime();
+	for(int t = 0; t < tasks; t++) for(int i = 1; i <= iterations; i++) for(int v = 0; v < neighbors; v++) sink += config.getMessageNumber(t, i, v);
+	runtimeTime = wallTime() - start;
+	for(int t = 0; t < tasks; t++) for(int i = 1; i <= iterations; i++) for(int v = 0; v < neighbors; v++) mismatches += (getMessageNumber(t, i, v) != config.getMessageNumber(t, i, v));
+	cout << "getMessageNumber\t" << calls << "\t" << nativeTime / calls * 1e9 << "\t\t\t" << runtimeTime / calls * 1e9 << "\t\t\t" << mismatches << endl;
+
+	//getMessageSize
+	calls = (long)tasks * iterations * neighbors * msgs; mismatches = 0;
+	start = wallTime();
+	for(int t = 0; t < tasks; t++) for(int i = 1; i <= iterations; i++) for(int v = 0; v < neighbors; v++) for(int u = 0; u < msgs; u++) sink += nativeGetMessageSize(t, i, v, u);
+	nativeTime = wallTime() - start;
+	start = wallTime();
+	for(int t = 0; t < tasks; t++) for(int i = 1; i <= iterations; i++) for(int v = 0; v < neighbors; v++) for(int u = 0; u < msgs; u++) sink += config.getMessageSize(t, i, v, u);
+	runtimeTime = wallTime() - start;
+	for(int t = 0; t < tasks; t++) for(int i = 1; i <= iterations; i++) for(int v = 0; v < neighbors; v++) for(int u = 0; u < msgs; u++) mismatches += (getMessageSize(t, i, v, u) != config.getMessageSize(t, i, v, u));
+	cout << "getMessageSize\t\t" << calls << "\t" << nativeTime / calls * 1e9 << "\t\t\t" << runtimeTime / calls * 1e9 << "\t\t\t" << mismatches << endl;
+
+	//other attributes
+	mismatches = 0;
+	for(int t = 0; t < tasks; t++){
+		mismatches += (getTaskSize(t) != config.getTaskSize(t));
+		mismatches += (getLoad(t, 1) != config.getLoad(t, 1)); //'$' without memo
+		for(int i = 1; i <= iterations; i++) mismatches += (getKernel(t, i) != config.getKernel(t, i));
+		mismatches += (getInitialMapping(t, 64) != config.getInitialMapping(t, 64));
+	}
+	mismatches += (getNumberOfTasks() != config.numberOfTasks) + (getNumberOfIterations() != config.numberOfIterations);
+	mismatches += (getLBFrequency() != config.lbFrequency) + (getCommunicationGraph() != config.commGraph);
+	mismatches += (getGraphDegree() != config.graphDegree) + (getGraphSeed() != config.graphSeed) + (getGraphFile() != config.file.gFileExp);
+	mismatches += (isMessageNumberIterationInvariant() != config.messageNumberIterationInvariant);
+	const char *attributes[] = {"n", "r", "gcomm", "lbfreq", "int_op", "tasksize", "load", "msgsize", "msgnum", "initmap", "gdegree", "gseed", "gfile", "kernel"};
+	for(int a = 0; a < 14; a++) mismatches += (getExpr(attributes[a]) != config.file.getExpr(attributes[a]));
+	cout << "other attributes mismatches: " << mismatches << endl;
+
+	return 0;
+}
@@ -0,0 +1,40 @@
+#ifndef RUNTIME_CONFIG_H
+#define RUNTIME_CONFIG_H
+
+#include <string>
+#include "config_file.h"
+#include "expression.h"
+
+/* Config file expressions compiled at startup, so a single binary can run any
+   config file. Provides the same functions config_reader generates. */
+class RuntimeConfig {
+	public:
+	ConfigFile file;
+	int numberOfTasks;
+	int numberOfIterations;
+	int lbFrequency;
+	int commGraph;
+	int graphDegree;
+	int graphSeed;
+	bool messageNumberIterationInvariant;
+
+	//read and compile a config file; returns false and sets error on failure
+	bool read(const std::string &fileName, std::string &error);
+
+	int getInitialMapping(int task, int numPes) const;
+	bool getIntOper(int task, int iteration) const;
+	int getKernel(int task, int iteration) const;
+	int getTaskSize(int task) const;
+	int getMessageSize(int task, int iteration, int neighbor, int msgIndex) const;
+	int getMessageNumber(int task, int iteration, int neighbor) const;
+	int getLoad(int task, int iteration) const;
+	int getLoad(int task, int iteration, int previousIteration, int previousLoad) const;
+
+	private:
+	Expression initialMapping, intOper, kernel, taskSize, load, messageSize, messageNumber;
+
+	bool compile(Expression &expression, const std::string &source, int variables, bool allowPrevious, std::string &error);
+	ExpressionContext context() const;
+};
+
+#endif
@@ -0,0 +1,129 @@
+#!/bin/bash
+
+# Run an experiment matrix with the runtime config binary (make runtime) and write
+# the results to <prefix>.csv (one line per run), <prefix>_lb.csv (one line per LB
+# step) and <prefix>.json. The output of every run is kept in <prefix>_logs.
+#
+# Build with DEFS=-DREPLAY_MODE=1 to screen strategies with the replay mode.
+#
+# The matrix file is a bash file that sets:
+#   configs="ring.cfg mesh.cfg"       config files
+#   pes="2 4 8"                       numbers of processors (+p)
+#   balancers="GreedyLB RefineLB"     CommonLBs strategies (+balancer), none runs without a strategy
+#   reps=3                            repetitions of each run (default 1)
+#   warmup=2                          first iterations left out of the iteration times (default 0)
+#   args="+LBSyncResume"              extra arguments of every run (optional)
+#   argsets=("" "+replay_alpha 1e-5")  alternative extra arguments, one more matrix dimension (optional)
+#   launcher="./charmrun"             command that starts the binary (optional)
+
+if [ $# -ne 1 ] && [ $# -ne 2 ]
+then
+	echo "usage: bash sweep.sh matrix_file [output_prefix]"
+	exit 1
+fi
+
+if [ ! -f $1  ]
+then
+	echo "Error: $1 file not found."
+	exit 1
+fi
+
+PREFIX=${2:-sweep}
+configs=""
+pes=1
+balancers=none
+reps=1
+warmup=0
+args=""
+argsets=("")
+launcher=""
+source $1
+
+for CONFIG in $configs
+do
+	if [ ! -f $CONFIG ]
+	then
+		echo "Error: $CONFIG file not found."
+		exit 1
+	fi
+done
+
+make runtime output_file=teste_sweep > /dev/null || exit 1
+
+RUNS_CSV=$PREFIX.csv
+LB_CSV=${PREFIX}_lb.csv
+JSON=$PREFIX.json
+LOGS=${PREFIX}_logs
+mkdir -p $LOGS
+
+echo "config,pes,balancer,args,rep,status,iterations,mean_iteration_ms,max_iteration_ms,total_ms,lb_total_ms,msg_rate" > $RUNS_CSV
+echo "config,pes,balancer,args,rep,step,iteration,migrations,bytes,imbalance_before,imbalance_after,cross_pe_edges_before,cross_pe_edges_after,decision_ms,migration_ms" > $LB_CSV
+echo "[" > $JSON
+
+SEPARATOR=""
+for CONFIG in $configs
+do
+	for PES in $pes
+	do
+		for LB in $balancers
+		do
+			for SET in ${!argsets[@]}
+			do
+				RUN_ARGS=${argsets[$SET]}
+				for REP in $(seq 1 $reps)
+				do
+					LB_ARG=""
+					if [ "$LB" != "none" ]
+					then
+						LB_ARG="+balancer $LB"
+					fi
+
+					LOG=$LOGS/$(basename $CONFIG)_p${PES}_${LB}_${SET}_${REP}.txt
+					$launcher ./teste_sweep +p$PES +config $CONFIG $LB_ARG $args $RUN_ARGS > $LOG 2>&1
+					if [ $? -eq 0 ]
+					then
+						STATUS=ok
+					else
+						STATUS=failed
+					fi
+
+					#iterations, mean, max and total of the iteration times after the warm-up, LB total time and message rate
+					SUMMARY=$(awk -v warmup=$warmup '
+						/^Iteration times/ {
+							n = split(substr($0, 17), times, ",")
+							for(i = warmup + 1; i <= n; i++){
+								time = times[i] + 0
+								count++
+								sum += time
+								if(time > max) max = time
+							}
+						}
+						/^LB total time/ { lb = $4 }
+						/^Message rate/ { rate = $3 }
+						END { printf "%d,%.3f,%.3f,%.3f,%.3f,%.1f", count, (count > 0) ? sum / count : 0, max, sum, lb, rate }' $LOG)
+					echo "$CONFIG,$PES,$LB,\"$RUN_ARGS\",$REP,$STATUS,$SUMMARY" >> $RUNS_CSV
+
+					awk -v run="$CONFIG,$PES,$LB,\"$RUN_ARGS\",$REP" '$1 == "LBSTEP" { printf "%s", run; for(i = 2; i <= NF; i++) printf ",%s", $i; printf "\n" }' $LOG >> $LB_CSV
+
+					LB_STEPS=$(awk '$1 == "LBSTEP" {
+						printf "%s{\"step\": %s, \"iteration\": %s, \"migrations\": %s, \"bytes\": %s, \"imbalance_before\": %s, \"imbalance_after\": %s, ", separator, $2, $3, $4, $5, $6, $7
+						printf "\"cross_pe_edges_before\": %s, \"cross_pe_edges_after\": %s, \"decision_ms\": %s, \"migration_ms\": %s}", $8, $9, $10, $11
+						separator = ", "
+					}' $LOG)
+					echo "$SUMMARY" | awk -F, -v config="$CONFIG" -v pes=$PES -v lb="$LB" -v args="$RUN_ARGS" -v rep=$REP -v status=$STATUS -v separator="$SEPARATOR" -v steps="$LB_STEPS" '{
+						printf "%s{\"config\": \"%s\", \"pes\": %d, \"balancer\": \"%s\", \"args\": \"%s\", \"rep\": %d, \"status\": \"%s\", ", separator, config, pes, lb, args, rep, status
+						printf "\"iterations\": %s, \"mean_iteration_ms\": %s, \"max_iteration_ms\": %s, \"total_ms\": %s, \"lb_total_ms\": %s, \"msg_rate\": %s, ", $1, $2, $3, $4, $5, $6
+						printf "\"lb_steps\": [%s]}\n", steps
+					}' >> $JSON
+					SEPARATOR=", "
+
+					echo "$CONFIG +p$PES $LB $RUN_ARGS #$REP: $STATUS, $(echo $SUMMARY | cut -d, -f2) ms per iteration"
+				done
+			done
+		done
+	done
+done
+
+echo "]" >> $JSON
+rm -f teste_sweep
+make clean > /dev/null
@@ -0,0 +1,33 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+/* Binary trace of per-task statistics, written when TRACE_TASKS is enabled: each PE
+   writes a file with a TraceHeader followed by the TaskInfo records of the tasks that
+   ran on it, in the order the tasks ended their iterations. Values are stored in the
+   native byte order of the machine that ran the benchmark. */
+
+#define TRACE_MAGIC "TASKTRC1"
+
+struct TraceHeader {
+	char magic[8];
+	int numberOfTasks;
+	int numberOfIterations;
+	int recordSize; //sizeof(TaskInfo) of the writer
+	int pe; //PE that wrote the file
+};
+
+/* Statistics of one task in one iteration */
+struct TaskInfo {
+	int task;
+	int iteration;
+	int pu;
+	int opType;
+	double workTime; //seconds
+	double latency; //seconds from the start of the work to the end of the iteration
+	int load;
+	int size;
+	int msgsSent;
+	int msgsReceived;
+};
+
+#endif
@@ -0,0 +1,55 @@
+#include <stdio.h>
+#include <string.h>
+#include "trace.h"
+
+/* Convert the per-PE traces written with TRACE_TASKS to CSV */
+
+int main(int argc, char **argv){
+	if(argc < 2){
+		fprintf(stderr, "usage: trace_reader trace_file... > csv_file\n");
+		return 1;
+	}
+
+	const char *kernels[] = {"IntOps", "FloatOps", "Triad", "PointerChase", "Fma", "Stencil"};
+	const int numberOfKernels = sizeof(kernels) / sizeof(kernels[0]);
+
+	printf("task,iteration,pe,kernel,work_time_ms,latency_ms,load,size,msgs_sent,msgs_received\n");
+	TaskInfo records[4096];
+	long total = 0, expected = 0;
+	for(int f = 1; f < argc; f++){
+		FILE *in = fopen(argv[f], "rb");
+		if(in == NULL){
+			fprintf(stderr, "could not open %s\n", argv[f]);
+			return 1;
+		}
+
+		TraceHeader header;
+		if(fread(&header, sizeof(header), 1, in) != 1 || memcmp(header.magic, TRACE_MAGIC, sizeof(header.magic)) != 0){
+			fprintf(stderr, "%s is not a task trace\n", argv[f]);
+			return 1;
+		}
+		if(header.recordSize != sizeof(TaskInfo)){
+			fprintf(stderr, "%s has records of %d bytes, expected %d\n", argv[f], header.recordSize, (int)sizeof(TaskInfo));
+			return 1;
+		}
+		expected = (long)header.numberOfTasks * header.numberOfIterations;
+
+		size_t count;
+		while((count = fread(records, sizeof(TaskInfo), 4096, in)) > 0){
+			for(size_t r = 0; r < count; r++){
+				TaskInfo &record = records[r];
+				printf("%d,%d,%d,%s,%.3f,%.3f,%d,%d,%d,%d\n", record.task, record.iteration, record.pu,
+					(record.opType >= 0 && record.opType < numberOfKernels) ? kernels[record.opType] : "?",
+					record.workTime * 1e3, record.latency * 1e3, record.load, record.size, record.msgsSent, record.msgsReceived);
+			}
+			total += count;
+		}
+		fclose(in);
+	}
+
+	//every task and iteration is in the trace of one PE
+	if(total != expected)
+		fprintf(stderr, "warning: %ld records, expected %ld (were the files of all PEs given?)\n", total, expected);
+
+	return 0;
+}